@@ -22,6 +22,7 @@ See notes at end for glyph nomenclature & other tidbits.
 #include <ft2build.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include FT_GLYPH_H
 #include FT_MODULE_H
 #include FT_TRUETYPE_DRIVER_H
@@ -66,7 +67,8 @@ int main(int argc, char *argv[]) {
   //   fontconvert [filename] [size] [last char]
   //   fontconvert [filename] [size] [first char] [last char]
   // Unless overridden, default first and last chars are
-  // ' ' (space) and 255, respectively
+  // ' ' (space) and 255, respectively. Chars may be given in decimal or,
+  // prefixed with 0x, in hexadecimal
 
   if (argc < 3) {
     fprintf(stderr, "Usage: %s fontfile size [first] [last]\n", argv[0]);
@@ -76,10 +78,10 @@ int main(int argc, char *argv[]) {
   size = atoi(argv[2]);
 
   if (argc == 4) {
-    last = atoi(argv[3]);
+    last = strtol(argv[3], NULL, 0);
   } else if (argc == 5) {
-    first = atoi(argv[3]);
-    last = atoi(argv[4]);
+    first = strtol(argv[3], NULL, 0);
+    last = strtol(argv[4], NULL, 0);
   }
 
   if (last < first) {
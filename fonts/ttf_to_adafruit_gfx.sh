@@ -19,6 +19,10 @@ TTF_FILES=ttf/*
 OUTPUT_PATH="./fonts"
 SIZES=(4 5 6 7 8 9 10 11 12 14 16 18 20 22 24 26)
 TEMPERATURE_SIZES=(48)
+# further ranges of Unicode to generate at each size, as "<name> <first> <last>",
+# for locales beyond ISO-8859-1, e.g.
+#   RANGES=("greek 0x370 0x3FF" "cyrillic 0x400 0x45F")
+RANGES=()
 
 # clean fonts output
 echo "Cleaning $OUTPUT_PATH"
@@ -73,6 +77,14 @@ for fontfile in $TTF_FILES
     ./fontconvert/fontconvert ${fontfile} $SI > $OUTFILE
     sed -i "s/${SI}pt8b/_${SI}pt8b/g" $OUTFILE
     # sed -i "s/_remap${SI}pt8b/${SI}pt8b/g" $OUTFILE
+    for RANGE in "${RANGES[@]}"
+      do
+      read NAME FIRST LAST <<< "$RANGE"
+      OUTFILE=$OUTPUT_PATH/$FONT/$FONT"_"$SI"pt8b_range_"$NAME".h"
+      echo "fontconvert ${fontfile} $SI $FIRST $LAST > $OUTFILE"
+      ./fontconvert/fontconvert ${fontfile} $SI $FIRST $LAST > $OUTFILE
+      sed -i "s/${SI}pt8b/_${SI}pt8b_range_${NAME}/g" $OUTFILE
+    done
   done
   for SI in ${TEMPERATURE_SIZES[*]}
     do
@@ -14,81 +14,96 @@
 # You should have received a copy of the GNU General Public License
 # along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+# Icons are stored run-length encoded:
+#   bytes 0-1  width, little-endian
+#   bytes 2-3  height, little-endian
+#   then the lengths of the runs of pixels of the same color, row after row
+#   with no padding, alternating between background and ink and starting with
+#   background (which may be a run of 0). Each length is a varint, 7 bits per
+#   byte starting with the least significant, the top bit set on every byte but
+#   the last. The runs add up to width * height pixels.
+# See blitIcon() in platformio/src/display_list.cpp for the decoder.
+
 import getopt
 import os.path
 import sys
 from PIL import Image
 
 BITES_PER_LINE = 12
-BITS_PER_BITE = 8
 THRESHOLD = 127
 
-try:
-    opts, args = getopt.getopt(sys.argv[1:],"hi:o:",["inputfile=","outputfile="])
-except getopt.GetoptError:
-    print('png_to_header.py -i <inputfile> -o <outputfile>')
-    sys.exit(2)
-for opt, arg in opts:
-    if opt == '-h':
-        print('png_to_header.py -i <inputfile> -o <outputfile>')
-        sys.exit()
-    elif opt in ("-i", "--inputfile"):
-        inputfile = arg
-    elif opt in ("-o", "--outputfile"):
-        outputfile = arg
+def encode_varint(n):
+    out = []
+    while n >= 0x80:
+        out.append((n & 0x7F) | 0x80)
+        n >>= 7
+    out.append(n)
+    return out
 
-try: inputfile
-except NameError:
-    print("Error: inputfile is a required parameter. See usage -h.")
-    exit()
-try: outputfile
-except NameError:
-    print("Error: outputfile is a required parameter. See usage -h")
-    exit()
+def encode_icon(ink, width, height):
+    """Run-length encodes an icon. ink is a list of width * height booleans,
+    row after row, True where a pixel is drawn.
+    """
+    out = [width & 0xFF, width >> 8, height & 0xFF, height >> 8]
+    run = 0
+    inked = False
+    for pixel in ink:
+        if pixel != inked:
+            out += encode_varint(run)
+            run = 0
+            inked = pixel
+        run += 1
+    out += encode_varint(run)
+    return out
 
-src_image = Image.open(inputfile)
-# Converts the image to grayscale
-src_g = src_image.convert('L')
-# Creates a list of the pixel values
-pixels = list(src_g.getdata())
+def write_header(outputfile, data, width, height):
+    var = os.path.basename(outputfile)
+    var = var.rsplit('.h',1)[0]
 
-f = open(outputfile, "w")
-var = os.path.basename(outputfile)
-var = var.rsplit('.h',1)[0]
+    f = open(outputfile, "w")
+    f.write("// " + str(width) + " x " + str(height) + ", run-length encoded\n")
+    f.write("const unsigned char " + var + "[] PROGMEM = {\n ")
+    for i, b in enumerate(data):
+        f.write(" " + "0x{:02x}".format(b))
+        if i != len(data) - 1:
+            f.write(",")
+            if (i + 1) % BITES_PER_LINE == 0:
+                f.write("\n ")
+    f.write("\n};")
+    f.close()
+
+def main(argv):
+    try:
+        opts, args = getopt.getopt(argv,"hi:o:",["inputfile=","outputfile="])
+    except getopt.GetoptError:
+        print('png_to_header.py -i <inputfile> -o <outputfile>')
+        sys.exit(2)
+    for opt, arg in opts:
+        if opt == '-h':
+            print('png_to_header.py -i <inputfile> -o <outputfile>')
+            sys.exit()
+        elif opt in ("-i", "--inputfile"):
+            inputfile = arg
+        elif opt in ("-o", "--outputfile"):
+            outputfile = arg
 
-width, height = src_image.size
-f.write("// " + str(width) + " x " + str(height) + "\n")
-f.write("const unsigned char " + var + "[] PROGMEM = {\n ")
+    try: inputfile
+    except NameError:
+        print("Error: inputfile is a required parameter. See usage -h.")
+        exit()
+    try: outputfile
+    except NameError:
+        print("Error: outputfile is a required parameter. See usage -h")
+        exit()
 
-bit_cnt = 1
-transcribed_width = 1
-tmp_bite = 0
-n = len(pixels)
-line_width = 0
+    src_image = Image.open(inputfile)
+    # Converts the image to grayscale
+    src_g = src_image.convert('L')
+    # Dark pixels are drawn, light pixels are background
+    ink = [p <= THRESHOLD for p in src_g.getdata()]
 
-for i in range(n):
-    line_width += 1
-    if (pixels[i] > THRESHOLD):
-        tmp_bite |= 1
-    if (line_width == width):
-        tmp_bite <<= BITS_PER_BITE - bit_cnt
-        line_width = 0
-        bit_cnt = 8
-    # if there is still more room in the current byte, shift the bits to make room for the next new bit
-    if (bit_cnt < BITS_PER_BITE and i != n - 1):
-        tmp_bite <<= 1
-        bit_cnt += 1
-    # else byte must be complete, write the byte to file
-    elif (i != n - 1):
-        f.write(" " + "0x{:02x}".format(tmp_bite) + ",")
-        if (transcribed_width == BITES_PER_LINE):
-            f.write("\n ")
-            transcribed_width = 1
-        else:
-            transcribed_width += 1
-        tmp_bite = 0
-        bit_cnt = 1
+    width, height = src_image.size
+    write_header(outputfile, encode_icon(ink, width, height), width, height)
 
-tmp_bite <<= BITS_PER_BITE - bit_cnt
-f.write(" " + "0x{:02x}".format(tmp_bite) + "\n};")
-f.close()
+if __name__ == "__main__":
+    main(sys.argv[1:])
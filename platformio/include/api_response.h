@@ -202,6 +202,12 @@ typedef struct owm_components
 
 /*
  * Response from OpenWeatherMap's Air Pollution API
+ *
+ * The hourly arrays form a ring buffer of the last OWM_NUM_AIR_POLLUTION
+ * hours, newest being the index of the most recent hour. New hours are
+ * appended as they are received, so only the hours that are missing need to be
+ * requested. Each slot is one hour, hours that were never received have a dt
+ * of 0.
  */
 typedef struct owm_resp_air_pollution
 {
@@ -209,6 +215,7 @@ typedef struct owm_resp_air_pollution
   int              main_aqi[OWM_NUM_AIR_POLLUTION];   // Air Quality Index. Possible values: 1, 2, 3, 4, 5. Where 1 = Good, 2 = Fair, 3 = Moderate, 4 = Poor, 5 = Very Poor.
   owm_components_t components;
   int64_t          dt[OWM_NUM_AIR_POLLUTION];         // Date and time, Unix, UTC;
+  int              newest;                            // Index of the most recent hour
 } owm_resp_air_pollution_t;
 
 DeserializationError deserializeOneCall(WiFiClient &json,
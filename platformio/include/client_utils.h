@@ -26,6 +26,30 @@
 #else
   #include <WiFiClientSecure.h>
 #endif
+#if !defined(USE_HTTP) && defined(USE_TLS_SESSION_RESUMPTION)
+  #include "tls_resume.h"
+#endif
+
+#ifdef USE_HTTP
+  typedef WiFiClient owm_client_t;
+#elif defined(USE_TLS_SESSION_RESUMPTION)
+  typedef ResumableClientSecure owm_client_t;
+#else
+  typedef WiFiClientSecure owm_client_t;
+#endif
+
+// Each OpenWeatherMap request makes up to OWM_ATTEMPTS attempts, each bounded
+// by these timeouts, so that a request returns within OWM_REQUEST_TIMEOUT
+// (the wake job making it is given longer, see main.cpp). The read timeout
+// bounds each wait for more of the response, so only a response that keeps
+// trickling in can take longer.
+#define OWM_ATTEMPTS          3
+#define OWM_CONNECT_TIMEOUT   5000 // ms
+#define OWM_HANDSHAKE_TIMEOUT 5000 // ms, whole seconds
+#define OWM_READ_TIMEOUT      8000 // ms
+#define OWM_REQUEST_TIMEOUT   (OWM_ATTEMPTS * (OWM_CONNECT_TIMEOUT           \
+                                               + OWM_HANDSHAKE_TIMEOUT       \
+                                               + OWM_READ_TIMEOUT)) // ms
 
 wl_status_t startWiFi(int &wifiRSSI);
 void killWiFi();
@@ -38,6 +62,7 @@ bool printLocalTime(tm *timeInfo);
   int getOWMonecall(WiFiClientSecure &client, owm_resp_onecall_t &r);
   int getOWMairpollution(WiFiClientSecure &client, owm_resp_air_pollution_t &r);
 #endif
+void setupOWMclient(owm_client_t &client);
 
 
 #endif
@@ -47,7 +47,8 @@
 // LOCALE
 // If your locale is not here, you can add it by copying and modifying one of
 // the files in src/locales. Please feel free to create a pull request to add
-// official support for your locale.
+// official support for your locale. Locale files are UTF-8; letters beyond
+// ISO-8859-1 need extra font ranges, see fonts/README.
 //   Language (Territory)            code
 //   German (Germany)                de_DE
 //   English (United Kingdom)        en_GB
@@ -129,20 +130,48 @@
 #define USE_HTTPS_NO_CERT_VERIF
 // #define USE_HTTPS_WITH_CERT_VERIF
 
+// TLS SESSION RESUMPTION
+//   When using HTTPS, the TLS session negotiated with the server is kept in RTC
+//   memory through deep-sleep and offered to the server on the next wake. If
+//   the server accepts it, the public key operations of a full handshake are
+//   skipped, which is the largest share of CPU time spent awake. If the server
+//   rejects it, a full handshake is performed as usual.
+//   Comment out to always perform a full handshake.
+#define USE_TLS_SESSION_RESUMPTION
+
+// WIFI FAST CONNECT
+//   The access point (BSSID and channel) and IP configuration of the last
+//   successful connection are kept in RTC memory through deep-sleep. On the
+//   next wake they are used to connect without scanning for the network or
+//   waiting for DHCP. If that fails, a normal connection is made.
+//   Since the DHCP lease is not renewed while it is reused, a normal connection
+//   is also made every so often so the address is not kept past its lease.
+//   Comment out to always scan and use DHCP.
+#define USE_WIFI_FAST_CONNECT
+
+// CONCURRENT API REQUESTS
+//   If defined, the One Call and Air Pollution requests are made at the same
+//   time, each on its own connection and FreeRTOS task, one per core. Time
+//   spent awake approaches that of the slower request rather than the sum of
+//   both, but each connection needs its own TLS context (tens of KB of heap)
+//   and handshake, which undoes the keep-alive connection shared by the
+//   requests made one after the other. Only enable this if the wake profiler
+//   shows it saving energy despite the second handshake.
+// #define USE_CONCURRENT_API_REQUESTS
+
 // WIND ICON PRECISION
 // The wind direction icon shown to the left of the wind speed can indicate wind
-// direction with a minimum error of ±0.5°. This uses more flash storage because
-// 360 24x24 wind direction icons must be stored, totaling ~25kB. For either
-// preference or in case flash space becomes a concern there are a handful of
-// selectable options listed below. 360 points seems excessive, but the option
-// is there.
+// direction with a minimum error of ±0.5°. Only one wind direction icon is
+// stored, it is rotated when drawn, so every option uses the same flash
+// storage. There are a handful of selectable options listed below for
+// preference. 360 points seems excessive, but the option is there.
 //
-//   DIRECTIONS                 #     ERROR  STORAGE
-//   Cardinal                   4  ±45.000°     288B  E
-//   Ordinal                    8  ±22.500°     576B  NE
-//   Secondary Intercardinal   16  ±11.250°   1,152B  NNE
-//   Tertiary Intercardinal    32   ±5.625°   2,304B  NbE
-//   (360)                    360   ±0.500°  25,920B  1°
+//   DIRECTIONS                 #     ERROR
+//   Cardinal                   4  ±45.000°  E
+//   Ordinal                    8  ±22.500°  NE
+//   Secondary Intercardinal   16  ±11.250°  NNE
+//   Tertiary Intercardinal    32   ±5.625°  NbE
+//   (360)                    360   ±0.500°  1°
 // Uncomment your preferred wind level direction precision.
 // #define WIND_DIRECTIONS_CARDINAL
 // #define WIND_DIRECTIONS_ORDINAL
@@ -172,6 +201,9 @@
 //   Ubuntu Mono    UbuntuMono_R.h           Ubuntu font     UFL v1.0
 //
 // Adding new fonts is relatively straightforward, see fonts/README.
+// Only the glyphs of characters the firmware can print (printable ASCII, the
+// strings of the selected LOCALE and the letters of its language) are compiled
+// in, see scripts/font_subset.py.
 //
 // Note:
 //   The layout of the display was designed around spacing and size of the GNU
@@ -189,6 +221,75 @@
 //   Disable alerts by defining the DISABLE_ALERTS macro.
 // #define DISABLE_ALERTS
 
+// STREAMING JSON PARSER
+//   The One Call API response is around 20-30 KB. By default it is parsed
+//   directly from the network stream, field by field, so no document tree is
+//   ever allocated. Undefining this macro falls back to ArduinoJson's
+//   deserializeJson, which needs a 32 KB heap allocation to hold the document.
+#define USE_STREAMING_JSON_PARSER
+
+// SKIP UNCHANGED FRAMES
+//   A full refresh of the panel takes several seconds and is the largest use of
+//   energy after WiFi. If the frame drawn on a wake is the same as the one
+//   already on the display, the display is left as is.
+//   The refresh time, battery and WiFi signal readings in the status bar are
+//   left out of the comparison since they change on almost every wake, only
+//   the status bar icons are compared. The readings are brought up to date by
+//   the next refresh, which happens at least every
+//   MAX_SKIPPED_REFRESHES + 1 wakes (see config.cpp). The refresh time shown is
+//   always when the display was last refreshed.
+//   Comment out to refresh the display on every wake.
+#define SKIP_UNCHANGED_FRAMES
+
+// PARTIAL REFRESH
+//   Most wakes only change a few blocks of the layout, like the current
+//   temperature or the outlook graph. If defined, only the blocks that changed
+//   since the last wake are redrawn, using a partial refresh. Partial refreshes
+//   are quicker and do not flash the panel, but leave some ghosting behind, so
+//   the whole display is refreshed every FULL_REFRESH_INTERVAL + 1 refreshes
+//   (see config.cpp). Nearby blocks are refreshed together, and a full refresh
+//   is done instead if most of the display changed (see PARTIAL_MAX_AREA).
+//   Only used by panels that support fast partial updates (DISP_BW_V2 and
+//   DISP_BW_V1), the others always use a full refresh. The panel must stay
+//   powered during deep-sleep so that it keeps the last frame drawn.
+//   Comment out to always use a full refresh.
+#define PARTIAL_REFRESH
+
+// WAKE PROFILER
+//   If defined, each stage of a wake (WiFi connection, API requests, SNTP wait,
+//   rendering, panel refresh, etc.) is timed, and the times of the last
+//   WAKE_PROFILE_HISTORY wakes are kept in RTC memory. Before deep-sleep, the
+//   minimum, average and maximum time spent in each stage is printed over the
+//   serial port.
+//   If WAKE_PROFILER_STATUS_BAR is also defined, the average time awake is
+//   shown in the status bar.
+#define WAKE_PROFILER
+#define WAKE_PROFILE_HISTORY 16
+// #define WAKE_PROFILER_STATUS_BAR
+
+// BACKGROUND DISPLAY TASKS
+//   Resetting the panel at the start of a wake and powering it off after a
+//   refresh are both spent mostly waiting on the panel. If defined, the panel is
+//   reset on a FreeRTOS task of its own while WiFi connects and the API
+//   requests are made, and powered off on that task while deep-sleep is
+//   prepared, instead of in line. With SKIP_UNCHANGED_FRAMES the panel is
+//   instead reset in line once the frame is known to have changed, so that
+//   wakes that skip the refresh never reset or power on the panel.
+//   Comment out to reset and power off the panel in line.
+#define USE_BACKGROUND_DISPLAY_TASKS
+
+// DOUBLE-BUFFERED PAGES
+//   The display is drawn a page at a time, each page is rendered and then sent
+//   to the panel before the next one is rendered. If defined, full refreshes
+//   are rendered into two buffers of their own instead, the next page on core 1
+//   while the last one is sent to the panel by a task on core 0. The buffers
+//   are in the controller's format, so lines and patterns are written to them
+//   a byte at a time.
+//   The buffers take ~48 kB of heap. If they cannot be allocated, pages are
+//   drawn one after the other.
+//   Partial refreshes (see PARTIAL_REFRESH) are always drawn a page at a time.
+#define USE_DOUBLE_BUFFERED_PAGES
+
 // DEBUG
 //   If defined, enables increase verbosity over the serial port.
 //   level 0: basic status information, assists troubleshooting (default)
@@ -210,6 +311,7 @@ extern const uint8_t BME_ADDRESS;
 extern const char *WIFI_SSID;
 extern const char *WIFI_PASSWORD;
 extern const unsigned long WIFI_TIMEOUT;
+extern const unsigned long WIFI_FAST_CONNECT_TIMEOUT;
 extern const String OWM_APIKEY;
 extern const String OWM_ENDPOINT;
 extern const String OWM_ONECALL_VERSION;
@@ -234,6 +336,11 @@ extern const float VERY_LOW_BATTERY_VOLTAGE;
 extern const float CRIT_LOW_BATTERY_VOLTAGE;
 extern const unsigned long LOW_BATTERY_SLEEP_INTERVAL;
 extern const unsigned long VERY_LOW_BATTERY_SLEEP_INTERVAL;
+extern const int MAX_SKIPPED_REFRESHES;
+extern const int FULL_REFRESH_INTERVAL;
+extern const int PARTIAL_MERGE_GAP;
+extern const int PARTIAL_MAX_WINDOWS;
+extern const int PARTIAL_MAX_AREA;
 
 #endif
 
@@ -0,0 +1,142 @@
+/* Display list declarations for esp32-weather-epd.
+ * Copyright (C) 2022-2023  Luke Marzen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __DISPLAY_LIST_H__
+#define __DISPLAY_LIST_H__
+
+#include <cstdint>
+#include <vector>
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include "text_metrics.h"
+
+typedef enum dl_cmd_type
+{
+  DL_BITMAP,        // run-length encoded icon filling the bounding box,
+                    // rotated about its center
+  DL_TEXT,          // run of text in one font
+  DL_LINE,          // line between opposite corners of the bounding box
+  DL_PATTERN,       // bounding box tiled with a bit pattern
+} dl_cmd_type_t;
+
+/*
+ * A w x h (at most 8 x 8) tile of pixels. Bit 7 of rows[i] is the leftmost
+ * pixel of row i, set bits are drawn and clear bits are left untouched.
+ */
+typedef struct dl_pattern
+{
+  uint8_t w, h;
+  uint8_t rows[8];
+} dl_pattern_t;
+
+/*
+ * A single recorded draw call. The bounding box (inclusive) covers every pixel
+ * the command may set.
+ */
+typedef struct dl_cmd
+{
+  dl_cmd_type_t type;
+  bool          transient;            // left out of hash()
+  uint8_t       region;
+  uint16_t      color;
+  int16_t       x0, y0;
+  int16_t       x1, y1;
+  union
+  {
+    struct
+    {
+      const uint8_t *data;
+      int16_t        angle;           // clockwise rotation, in degrees
+    } icon;                           // DL_BITMAP
+    bool           rising;            // DL_LINE, runs from (x0, y1) to (x1, y0)
+    dl_pattern_t   pattern;           // DL_PATTERN, tiled from x0, y0
+    struct
+    {
+      const unicode_font_t *font;
+      int16_t               x, y;     // cursor
+      uint16_t              offset;   // into the text pool, UTF-8
+    } text;                           // DL_TEXT
+  };
+} dl_cmd_t;
+
+/*
+ * Hash and bounding box (inclusive) of the commands recorded in a region. The
+ * bounding box is empty, x1 < x0, if there are none.
+ */
+typedef struct dl_region
+{
+  uint32_t hash;
+  int16_t  x0, y0;
+  int16_t  x1, y1;
+} dl_region_t;
+
+class PageCanvas;
+
+/*
+ * Records draw calls once so that they can be replayed for every page of a
+ * paged display without recomputing the layout.
+ *
+ * Only the bitmap, text, line and pattern primitives used by the renderer are
+ * supported. Recording a command only stores its parameters, nothing is drawn
+ * until replay(), which skips commands whose bounding box lies outside the
+ * page being drawn.
+ *
+ * Commands recorded while transient is set draw readings that change on
+ * almost every wake and are mostly left out when comparing frames by hash().
+ *
+ * Commands are also tagged with the region set when they were recorded, a
+ * block of the layout that can be compared and redrawn on its own.
+ */
+class DisplayList
+{
+public:
+  void clear();
+  size_t size() const;
+  uint32_t hash() const;
+  void setTransient(bool transient);
+  dl_region_t region(uint8_t id) const;
+  void setRegion(uint8_t id);
+
+  void setFont(const unicode_font_t *font);
+  const unicode_font_t *font() const;
+  void drawInvertedBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                          int16_t w, int16_t h, uint16_t color,
+                          int16_t angle=0);
+  void drawText(int16_t x, int16_t y, const char *text, size_t len,
+                uint16_t color, const text_bounds_t &bounds);
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                uint16_t color);
+  void fillPattern(int16_t x, int16_t y, int16_t w, int16_t h,
+                   const dl_pattern_t &pattern, uint16_t color);
+
+  void replay(Adafruit_GFX &gfx, int16_t top, int16_t bottom) const;
+  void replay(PageCanvas &page, int16_t top, int16_t bottom) const;
+
+private:
+  void replay(Adafruit_GFX &gfx, PageCanvas *page, int16_t top,
+              int16_t bottom) const;
+
+  std::vector<dl_cmd_t> _cmds;
+  std::vector<char>     _text; // NUL terminated text of every DL_TEXT
+  const unicode_font_t *_font = nullptr;
+  bool                  _transient = false;
+  uint8_t               _region = 0;
+};
+
+extern DisplayList displayList;
+
+#endif
@@ -58,7 +58,8 @@ void toTitleCase(String &text);
 void truncateExtraAlertInfo(String &text);
 void filterAlerts(std::vector<owm_alerts_t> &resp, int *ignore_list);
 const char *getUVIdesc(unsigned int uvi);
-float getAvgConc(const float pollutant[], int hours);
+float getAvgConc(const float pollutant[], const int64_t dt[], int newest,
+                 int hours);
 int getAQI(const owm_resp_air_pollution_t &p);
 const char *getAQIdesc(int aqi);
 const char *getWiFidesc(int rssi);
@@ -69,7 +70,7 @@ const uint8_t *getCurrentConditionsBitmap196(const owm_current_t &current,
 const uint8_t *getAlertBitmap32(const owm_alerts_t &alert);
 const uint8_t *getAlertBitmap48(const owm_alerts_t &alert);
 enum alert_category getAlertCategory(const owm_alerts_t &alert);
-const uint8_t *getWindBitmap24(int windDeg);
+int getWindIconAngle(int windDeg);
 const char *getHttpResponsePhrase(int code);
 const char *getWifiStatusPhrase(wl_status_t status);
 void printHeapUsage();
@@ -1,174 +1,48 @@
-// 128 x 128
+// 128 x 128, run-length encoded
 const unsigned char biological_hazard_symbol_128x128[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xbf, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff,
-  0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xcf, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf8, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-  0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x7f, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff,
-  0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-  0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xe0, 0x03, 0xff, 0xe0, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xfe, 0x00,
-  0x00, 0x7f, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x07, 0xf8, 0x00, 0x00, 0x1f, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xe0, 0x00, 0x00, 0x07, 0xc0, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xc0, 0x00,
-  0x00, 0x03, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x01, 0xc0, 0x00, 0x00, 0x03, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xe0, 0x07, 0xe0, 0x07, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xf0, 0x7f,
-  0xfe, 0x0f, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x79, 0xff, 0xff, 0x9e, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff,
-  0xff, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x00, 0x07, 0xff, 0xff, 0xe0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x7f,
-  0xfe, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x01,
-  0x80, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x07,
-  0xe0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0x7f, 0xe0, 0x00, 0x0f, 0xf0, 0x00, 0x07, 0xff, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x03, 0xff, 0xfc, 0x00, 0x1f, 0xf8, 0x00, 0x3f, 0xff,
-  0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xfe, 0xfe, 0x00, 0x3f,
-  0xfc, 0x00, 0xff, 0x7f, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f,
-  0xfe, 0x0f, 0x80, 0x3f, 0xfc, 0x01, 0xf0, 0x7f, 0xfc, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x7f, 0xfe, 0x07, 0xc0, 0x3f, 0xfc, 0x03, 0xe0, 0x7f,
-  0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xfe, 0x07, 0xe0, 0x3f,
-  0xfc, 0x0f, 0xe0, 0x7f, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff,
-  0xfe, 0x07, 0xf8, 0x3f, 0xfc, 0x1f, 0xe0, 0x7f, 0xff, 0x87, 0xff, 0xff,
-  0xff, 0xff, 0xc3, 0xff, 0xfe, 0x07, 0xf8, 0x7f, 0xfe, 0x1f, 0xe0, 0x7f,
-  0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xfe, 0x07, 0xfd, 0xff,
-  0xff, 0xbf, 0xc0, 0x7f, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff,
-  0xfe, 0x03, 0xff, 0xcf, 0xf7, 0xff, 0xc0, 0x7f, 0xff, 0xe3, 0xff, 0xff,
-  0xff, 0xff, 0xcf, 0xff, 0xfe, 0x03, 0xff, 0x87, 0xc1, 0xff, 0xc0, 0xff,
-  0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x03, 0xff, 0x00,
-  0x00, 0xff, 0xc0, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff,
-  0xff, 0x01, 0xff, 0x00, 0x01, 0xff, 0x80, 0xff, 0xff, 0xf9, 0xff, 0xff,
-  0xff, 0xff, 0x9f, 0xff, 0xff, 0x01, 0xff, 0x80, 0x01, 0xff, 0x80, 0xff,
-  0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x80, 0xff, 0x80,
-  0x01, 0xff, 0x01, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff,
-  0xff, 0x80, 0xff, 0x80, 0x01, 0xfe, 0x01, 0xff, 0xff, 0xfd, 0xff, 0xff,
-  0xff, 0xff, 0xbf, 0xff, 0xff, 0xc0, 0x7f, 0x80, 0x03, 0xfe, 0x03, 0xff,
-  0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xc0, 0x3f, 0xc0,
-  0x03, 0xfc, 0x03, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff,
-  0xff, 0xe0, 0x1f, 0xc0, 0x03, 0xf8, 0x07, 0xff, 0xff, 0xfd, 0xff, 0xff,
-  0xff, 0xff, 0xbf, 0xff, 0xff, 0xe0, 0x0f, 0xc0, 0x03, 0xf0, 0x07, 0xff,
-  0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0x07, 0xc0,
-  0x03, 0xe0, 0x0f, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff,
-  0xff, 0xf8, 0x01, 0xc0, 0x03, 0x80, 0x1f, 0xff, 0xff, 0xfd, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xc0, 0x03, 0x80, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x01, 0xc0,
-  0x03, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x01, 0x80, 0x03, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x80, 0x01, 0x81, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x80,
-  0x01, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfb, 0x00, 0x01, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0x80, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x03,
-  0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x07, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0xff,
-  0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfc, 0x00, 0x3f,
-  0xf8, 0x00, 0x3f, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0xff, 0xe0, 0x00, 0x7f, 0xfe, 0x00, 0x07, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x07, 0xff,
-  0xff, 0xe0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x80, 0x00, 0x80, 0x00, 0xb6, 0x15, 0x01, 0x12, 0x01, 0x6a, 0x01, 0x15,
+  0x02, 0x66, 0x02, 0x18, 0x02, 0x62, 0x03, 0x1a, 0x03, 0x5f, 0x03, 0x1c,
+  0x03, 0x5d, 0x03, 0x1e, 0x03, 0x5b, 0x03, 0x20, 0x03, 0x59, 0x03, 0x22,
+  0x03, 0x57, 0x03, 0x23, 0x04, 0x55, 0x04, 0x24, 0x03, 0x55, 0x03, 0x25,
+  0x04, 0x53, 0x04, 0x26, 0x04, 0x52, 0x04, 0x26, 0x04, 0x51, 0x04, 0x27,
+  0x05, 0x50, 0x04, 0x28, 0x04, 0x4f, 0x05, 0x28, 0x05, 0x4e, 0x05, 0x28,
+  0x05, 0x4e, 0x05, 0x28, 0x05, 0x4d, 0x06, 0x28, 0x06, 0x4c, 0x06, 0x28,
+  0x06, 0x4c, 0x06, 0x28, 0x06, 0x4c, 0x06, 0x28, 0x06, 0x4c, 0x06, 0x28,
+  0x06, 0x4c, 0x06, 0x28, 0x07, 0x4b, 0x07, 0x0e, 0x0b, 0x0d, 0x08, 0x4b,
+  0x07, 0x0a, 0x12, 0x0a, 0x08, 0x4b, 0x07, 0x08, 0x16, 0x08, 0x08, 0x4b,
+  0x08, 0x05, 0x1a, 0x05, 0x08, 0x4c, 0x08, 0x04, 0x1c, 0x04, 0x08, 0x4c,
+  0x09, 0x03, 0x1c, 0x03, 0x09, 0x4c, 0x09, 0x04, 0x0a, 0x06, 0x0a, 0x03,
+  0x0a, 0x4c, 0x0a, 0x04, 0x05, 0x0e, 0x05, 0x04, 0x0a, 0x4d, 0x0a, 0x04,
+  0x02, 0x12, 0x02, 0x04, 0x0a, 0x4e, 0x0b, 0x1c, 0x0b, 0x4e, 0x0c, 0x19,
+  0x0d, 0x4a, 0x12, 0x16, 0x11, 0x45, 0x16, 0x12, 0x16, 0x40, 0x1a, 0x0e,
+  0x1a, 0x3c, 0x20, 0x06, 0x20, 0x39, 0x23, 0x02, 0x23, 0x36, 0x25, 0x02,
+  0x25, 0x33, 0x26, 0x02, 0x26, 0x31, 0x27, 0x02, 0x27, 0x2f, 0x26, 0x06,
+  0x26, 0x2d, 0x0b, 0x0a, 0x11, 0x08, 0x11, 0x0b, 0x09, 0x2d, 0x08, 0x10,
+  0x0d, 0x0a, 0x0d, 0x10, 0x08, 0x2b, 0x07, 0x0b, 0x01, 0x07, 0x0b, 0x0c,
+  0x0a, 0x08, 0x01, 0x0b, 0x07, 0x29, 0x06, 0x0d, 0x05, 0x05, 0x09, 0x0c,
+  0x09, 0x05, 0x05, 0x0d, 0x06, 0x28, 0x05, 0x0e, 0x06, 0x05, 0x08, 0x0c,
+  0x08, 0x05, 0x06, 0x0e, 0x05, 0x27, 0x05, 0x0f, 0x06, 0x06, 0x07, 0x0c,
+  0x06, 0x07, 0x06, 0x0f, 0x05, 0x26, 0x04, 0x10, 0x06, 0x08, 0x05, 0x0c,
+  0x05, 0x08, 0x06, 0x10, 0x04, 0x25, 0x04, 0x11, 0x06, 0x08, 0x04, 0x0e,
+  0x04, 0x08, 0x06, 0x11, 0x04, 0x24, 0x03, 0x12, 0x06, 0x09, 0x01, 0x12,
+  0x01, 0x08, 0x07, 0x12, 0x03, 0x24, 0x03, 0x12, 0x07, 0x0c, 0x02, 0x08,
+  0x01, 0x0d, 0x07, 0x12, 0x03, 0x24, 0x02, 0x13, 0x07, 0x0b, 0x04, 0x05,
+  0x05, 0x0b, 0x06, 0x14, 0x03, 0x22, 0x03, 0x14, 0x06, 0x0a, 0x10, 0x0a,
+  0x06, 0x15, 0x02, 0x22, 0x02, 0x15, 0x07, 0x09, 0x0f, 0x0a, 0x07, 0x15,
+  0x02, 0x22, 0x02, 0x15, 0x07, 0x0a, 0x0e, 0x0a, 0x07, 0x15, 0x02, 0x22,
+  0x01, 0x17, 0x07, 0x09, 0x0e, 0x09, 0x07, 0x17, 0x01, 0x22, 0x01, 0x17,
+  0x07, 0x09, 0x0e, 0x08, 0x08, 0x17, 0x01, 0x22, 0x01, 0x18, 0x07, 0x08,
+  0x0d, 0x09, 0x07, 0x18, 0x01, 0x22, 0x01, 0x18, 0x08, 0x08, 0x0c, 0x08,
+  0x08, 0x18, 0x01, 0x22, 0x01, 0x19, 0x08, 0x07, 0x0c, 0x07, 0x08, 0x19,
+  0x01, 0x22, 0x01, 0x19, 0x09, 0x06, 0x0c, 0x06, 0x09, 0x19, 0x01, 0x22,
+  0x01, 0x1a, 0x09, 0x05, 0x0c, 0x05, 0x09, 0x1a, 0x01, 0x22, 0x01, 0x1b,
+  0x0a, 0x03, 0x0c, 0x03, 0x0a, 0x1b, 0x01, 0x3f, 0x09, 0x03, 0x0c, 0x03,
+  0x09, 0x5d, 0x08, 0x03, 0x0c, 0x03, 0x08, 0x5f, 0x07, 0x02, 0x0d, 0x03,
+  0x07, 0x62, 0x05, 0x02, 0x0e, 0x02, 0x06, 0x64, 0x03, 0x03, 0x0e, 0x03,
+  0x03, 0x68, 0x01, 0x02, 0x0f, 0x03, 0x01, 0x6d, 0x10, 0x70, 0x10, 0x6f,
+  0x12, 0x6d, 0x13, 0x6d, 0x14, 0x6b, 0x16, 0x69, 0x0b, 0x02, 0x0b, 0x67,
+  0x0b, 0x04, 0x0b, 0x64, 0x0c, 0x06, 0x0b, 0x4c, 0x02, 0x14, 0x0c, 0x08,
+  0x0c, 0x14, 0x01, 0x37, 0x01, 0x11, 0x0c, 0x0b, 0x0d, 0x10, 0x02, 0x39,
+  0x03, 0x0b, 0x0e, 0x0e, 0x0e, 0x0a, 0x03, 0x3d, 0x18, 0x11, 0x19, 0x40,
+  0x14, 0x16, 0x13, 0x46, 0x0e, 0x1c, 0x0d, 0xa5, 0x14
 };
\ No newline at end of file
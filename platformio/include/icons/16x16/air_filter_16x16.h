@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char air_filter_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xfb, 0xdf, 0xfb, 0xdf,
-  0xfb, 0x07, 0xfb, 0xdf, 0xfb, 0x87, 0xfb, 0x5f, 0xfb, 0x87, 0xfb, 0xdf,
-  0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x35, 0x06, 0x0a, 0x01, 0x04, 0x01, 0x0a, 0x01,
+  0x04, 0x01, 0x0a, 0x01, 0x02, 0x05, 0x08, 0x01, 0x04, 0x01, 0x0a, 0x01,
+  0x03, 0x04, 0x08, 0x01, 0x02, 0x01, 0x01, 0x01, 0x0a, 0x01, 0x03, 0x04,
+  0x08, 0x01, 0x04, 0x01, 0x0a, 0x06, 0x35
 };
\ No newline at end of file
@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char battery_0_bar_270deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x01,
-  0xcf, 0xf9, 0x8f, 0xf9, 0x8f, 0xf9, 0xcf, 0xf9, 0xe0, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
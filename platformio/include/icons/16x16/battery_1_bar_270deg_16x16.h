@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char battery_1_bar_270deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x01,
-  0xcf, 0xf1, 0x8f, 0xf1, 0x8f, 0xf1, 0xcf, 0xf1, 0xe0, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char battery_3_bar_0deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xfe, 0x7f, 0xfc, 0x3f, 0xf8, 0x1f, 0xfb, 0xdf, 0xfb, 0xdf,
-  0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f,
-  0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x17, 0x02, 0x0d, 0x04, 0x0b, 0x06, 0x0a, 0x01,
+  0x04, 0x01, 0x0a, 0x01, 0x04, 0x01, 0x0a, 0x01, 0x04, 0x01, 0x0a, 0x01,
+  0x04, 0x01, 0x0a, 0x01, 0x04, 0x01, 0x0a, 0x06, 0x0a, 0x06, 0x0a, 0x06,
+  0x0a, 0x06, 0x0a, 0x06, 0x0a, 0x06, 0x15
 };
\ No newline at end of file
@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char battery_alert_180deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf9, 0x9f, 0xf8, 0x1f,
-  0xf8, 0x1f, 0xf9, 0x9f, 0xf9, 0x9f, 0xf9, 0x9f, 0xf8, 0x1f, 0xf8, 0x1f,
-  0xf8, 0x1f, 0xfc, 0x3f, 0xfe, 0x7f, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char biological_hazard_symbol_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdf, 0xfb, 0xdf,
-  0xf8, 0x9f, 0xf0, 0x0f, 0xf9, 0x9f, 0xfa, 0x5f, 0xfa, 0x5f, 0xfe, 0x7f,
-  0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x45, 0x01, 0x04, 0x01, 0x0a, 0x01, 0x04, 0x01,
+  0x0a, 0x03, 0x01, 0x02, 0x09, 0x08, 0x09, 0x02, 0x02, 0x02, 0x0a, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x0a, 0x01, 0x01, 0x02, 0x01, 0x01, 0x0c, 0x02,
+  0x0d, 0x04, 0x36
 };
\ No newline at end of file
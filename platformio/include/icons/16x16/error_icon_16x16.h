@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char error_icon_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xf3, 0xcf, 0xf7, 0xef,
-  0xef, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xf7, 0xef, 0xf3, 0xcf,
-  0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x36, 0x04, 0x0a, 0x02, 0x04, 0x02, 0x08, 0x01,
+  0x06, 0x01, 0x07, 0x01, 0x08, 0x01, 0x06, 0x01, 0x08, 0x01, 0x06, 0x01,
+  0x08, 0x01, 0x06, 0x01, 0x08, 0x01, 0x07, 0x01, 0x06, 0x01, 0x08, 0x02,
+  0x04, 0x02, 0x0a, 0x04, 0x36
 };
\ No newline at end of file
@@ -1,6 +1,8 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char house_raindrops_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x2f, 0xf9, 0x8f, 0xf3, 0xcf,
-  0xe7, 0xe7, 0xcd, 0xf3, 0xcd, 0xf3, 0xef, 0x37, 0xef, 0x37, 0xef, 0x37,
-  0xef, 0xf7, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x36, 0x04, 0x01, 0x01, 0x09, 0x02, 0x02, 0x03,
+  0x08, 0x02, 0x04, 0x02, 0x07, 0x02, 0x06, 0x02, 0x05, 0x02, 0x02, 0x01,
+  0x05, 0x02, 0x04, 0x02, 0x02, 0x01, 0x05, 0x02, 0x05, 0x01, 0x04, 0x02,
+  0x02, 0x01, 0x06, 0x01, 0x04, 0x02, 0x02, 0x01, 0x06, 0x01, 0x04, 0x02,
+  0x02, 0x01, 0x06, 0x01, 0x08, 0x01, 0x07, 0x08, 0x24
 };
\ No newline at end of file
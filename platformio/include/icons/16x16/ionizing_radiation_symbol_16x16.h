@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char ionizing_radiation_symbol_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xf3, 0xcf, 0xe1, 0x87,
-  0xe1, 0x87, 0xe2, 0x47, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f, 0xfc, 0x3f,
-  0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x34, 0x02, 0x04, 0x02, 0x08, 0x02, 0x04, 0x02,
+  0x07, 0x04, 0x02, 0x04, 0x06, 0x04, 0x02, 0x04, 0x06, 0x03, 0x01, 0x02,
+  0x01, 0x03, 0x0a, 0x02, 0x0e, 0x02, 0x0d, 0x04, 0x0c, 0x04, 0x0b, 0x06,
+  0x35
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char visibility_icon_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xf8, 0x1f,
-  0xf3, 0xcf, 0xe2, 0x47, 0xe2, 0x47, 0xf3, 0xcf, 0xf8, 0x1f, 0xfe, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x47, 0x02, 0x0c, 0x06, 0x09, 0x02, 0x04, 0x02,
+  0x07, 0x03, 0x01, 0x02, 0x01, 0x03, 0x06, 0x03, 0x01, 0x02, 0x01, 0x03,
+  0x07, 0x02, 0x04, 0x02, 0x09, 0x06, 0x0c, 0x02, 0x47
 };
\ No newline at end of file
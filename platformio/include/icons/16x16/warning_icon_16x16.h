@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char warning_icon_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfd, 0xbf, 0xfd, 0xbf,
-  0xfb, 0xdf, 0xfb, 0xdf, 0xf7, 0xef, 0xff, 0xff, 0xef, 0xf7, 0xdf, 0xfb,
-  0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x37, 0x02, 0x0d, 0x01, 0x02, 0x01, 0x0c, 0x01,
+  0x02, 0x01, 0x0b, 0x01, 0x04, 0x01, 0x0a, 0x01, 0x04, 0x01, 0x09, 0x01,
+  0x06, 0x01, 0x17, 0x01, 0x08, 0x01, 0x05, 0x01, 0x0a, 0x01, 0x05, 0x0a,
+  0x33
 };
\ No newline at end of file
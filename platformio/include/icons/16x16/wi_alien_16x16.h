@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_alien_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf8, 0x1f, 0xf8, 0x0f,
-  0xf0, 0x0f, 0xfe, 0x7f, 0xff, 0x7f, 0xfb, 0x5f, 0xfc, 0x3f, 0xfe, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x37, 0x03, 0x0b, 0x06, 0x0a, 0x07, 0x08, 0x08,
+  0x0b, 0x02, 0x0f, 0x01, 0x0c, 0x01, 0x02, 0x01, 0x01, 0x01, 0x0b, 0x04,
+  0x0d, 0x02, 0x47
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_barometer_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfb, 0x9f, 0xf7, 0xef,
-  0xf7, 0x6f, 0xf7, 0x6f, 0xf7, 0xef, 0xfb, 0xdf, 0xfc, 0x3f, 0xfe, 0x7f,
-  0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x36, 0x04, 0x0b, 0x01, 0x03, 0x02, 0x09, 0x01,
+  0x06, 0x01, 0x08, 0x01, 0x03, 0x01, 0x02, 0x01, 0x08, 0x01, 0x03, 0x01,
+  0x02, 0x01, 0x08, 0x01, 0x06, 0x01, 0x09, 0x01, 0x04, 0x01, 0x0b, 0x04,
+  0x0d, 0x02, 0x0e, 0x02, 0x37
 };
\ No newline at end of file
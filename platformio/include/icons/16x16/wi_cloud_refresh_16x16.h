@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_cloud_refresh_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfb, 0xbf,
-  0xf3, 0xcf, 0xee, 0x77, 0xec, 0x7f, 0xed, 0xff, 0xed, 0xb7, 0xf6, 0x6f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x46, 0x03, 0x0c, 0x01, 0x03, 0x01, 0x0a, 0x02,
+  0x04, 0x02, 0x07, 0x01, 0x03, 0x02, 0x03, 0x01, 0x06, 0x01, 0x02, 0x03,
+  0x0a, 0x01, 0x02, 0x01, 0x0c, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+  0x07, 0x01, 0x02, 0x02, 0x02, 0x01, 0x44
 };
\ No newline at end of file
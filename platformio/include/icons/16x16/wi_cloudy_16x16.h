@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_cloudy_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xf8, 0xef,
-  0xf7, 0x77, 0xe7, 0x3b, 0xdf, 0xdb, 0xdf, 0xe7, 0xdf, 0xdf, 0xf0, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x48, 0x03, 0x0a, 0x03, 0x03, 0x01, 0x08, 0x01,
+  0x03, 0x01, 0x03, 0x01, 0x06, 0x02, 0x03, 0x02, 0x03, 0x01, 0x04, 0x01,
+  0x07, 0x01, 0x02, 0x01, 0x04, 0x01, 0x08, 0x02, 0x05, 0x01, 0x07, 0x01,
+  0x09, 0x06, 0x46
 };
\ No newline at end of file
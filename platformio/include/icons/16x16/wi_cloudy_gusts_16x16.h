@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_cloudy_gusts_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xf9, 0xdf,
-  0xfb, 0xcf, 0xe6, 0x73, 0xff, 0x7b, 0xc0, 0x7b, 0xff, 0xf3, 0xc3, 0x0f,
-  0xf9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x46, 0x04, 0x0b, 0x02, 0x03, 0x01, 0x0a, 0x01,
+  0x04, 0x02, 0x07, 0x02, 0x02, 0x02, 0x03, 0x02, 0x0a, 0x01, 0x04, 0x01,
+  0x04, 0x07, 0x04, 0x01, 0x0e, 0x02, 0x04, 0x04, 0x02, 0x04, 0x09, 0x02,
+  0x0e, 0x01, 0x2a
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_cloudy_high_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf7, 0x7f, 0xef, 0x3f,
-  0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0x2b, 0xfe, 0xdf, 0xff, 0x3f, 0xfd, 0xff,
-  0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x35, 0x03, 0x0c, 0x01, 0x03, 0x01, 0x0a, 0x01,
+  0x04, 0x02, 0x08, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x08, 0x07,
+  0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x02, 0x01, 0x0d, 0x02, 0x0c, 0x01,
+  0x12, 0x01, 0x36
 };
\ No newline at end of file
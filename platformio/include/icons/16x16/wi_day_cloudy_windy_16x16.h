@@ -1,6 +1,8 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_cloudy_windy_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xdf, 0xfd, 0xfb, 0xff, 0xdf, 0xf8, 0x6f, 0xf7, 0x77,
-  0xef, 0xb5, 0xdf, 0xef, 0xff, 0xef, 0x81, 0xeb, 0xff, 0xef, 0x84, 0x1f,
-  0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x1a, 0x01, 0x0b, 0x01, 0x06, 0x01, 0x0c, 0x01,
+  0x0a, 0x04, 0x02, 0x01, 0x08, 0x01, 0x03, 0x01, 0x03, 0x01, 0x06, 0x01,
+  0x05, 0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x08, 0x01, 0x0f, 0x01,
+  0x05, 0x06, 0x04, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x05, 0x04, 0x01, 0x05,
+  0x07, 0x05, 0x39
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_fog_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xdf, 0xfd, 0xfb, 0xff, 0xdf, 0xf8, 0x6f, 0xf7, 0x77,
-  0xe7, 0x95, 0xdf, 0xe7, 0xff, 0xff, 0xc0, 0x0b, 0xff, 0xff, 0x80, 0x1f,
-  0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x1a, 0x01, 0x0b, 0x01, 0x06, 0x01, 0x0c, 0x01,
+  0x0a, 0x04, 0x02, 0x01, 0x08, 0x01, 0x03, 0x01, 0x03, 0x01, 0x06, 0x02,
+  0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x08, 0x02, 0x15, 0x0a,
+  0x01, 0x01, 0x13, 0x0a, 0x08, 0x0a, 0x33
 };
\ No newline at end of file
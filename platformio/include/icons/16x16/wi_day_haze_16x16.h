@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_haze_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xff, 0xff,
-  0xfc, 0x3f, 0xf9, 0x9f, 0xef, 0xf7, 0xf0, 0xcf, 0xff, 0xff, 0xfc, 0x9f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x44, 0x01, 0x06, 0x01, 0x1a, 0x04, 0x0b, 0x02,
+  0x02, 0x02, 0x08, 0x01, 0x08, 0x01, 0x07, 0x04, 0x02, 0x02, 0x1a, 0x02,
+  0x01, 0x02, 0x45
 };
\ No newline at end of file
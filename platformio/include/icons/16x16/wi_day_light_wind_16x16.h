@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_light_wind_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xbf, 0xfb, 0xf7, 0xff, 0x3f, 0xfe, 0xdf, 0xfd, 0xef,
-  0xf7, 0xeb, 0xc1, 0xdf, 0xff, 0x9f, 0xc0, 0xf7, 0xff, 0xbf, 0xc1, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x19, 0x01, 0x0b, 0x01, 0x06, 0x01, 0x0b, 0x02,
+  0x0d, 0x01, 0x02, 0x01, 0x0b, 0x01, 0x04, 0x01, 0x08, 0x01, 0x06, 0x01,
+  0x01, 0x01, 0x04, 0x05, 0x03, 0x01, 0x0e, 0x02, 0x07, 0x06, 0x04, 0x01,
+  0x0c, 0x01, 0x08, 0x05, 0x49
 };
\ No newline at end of file
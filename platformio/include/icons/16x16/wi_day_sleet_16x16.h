@@ -1,6 +1,8 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_sleet_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xbf, 0xfb, 0xfb, 0xff, 0xb7, 0xf0, 0x4f, 0xee, 0x6f,
-  0xef, 0x2d, 0x9f, 0xcf, 0xbf, 0xef, 0xbf, 0xef, 0x9f, 0xdf, 0xfd, 0xff,
-  0xf6, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x19, 0x01, 0x0b, 0x01, 0x07, 0x01, 0x0b, 0x01,
+  0x02, 0x01, 0x07, 0x05, 0x01, 0x02, 0x07, 0x01, 0x03, 0x02, 0x02, 0x01,
+  0x07, 0x01, 0x04, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x07, 0x02,
+  0x05, 0x01, 0x09, 0x01, 0x05, 0x01, 0x09, 0x01, 0x05, 0x02, 0x07, 0x01,
+  0x0b, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x1d, 0x01, 0x1a
 };
\ No newline at end of file
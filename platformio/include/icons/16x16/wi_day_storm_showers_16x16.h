@@ -1,6 +1,9 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_storm_showers_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xbf, 0xfb, 0xfb, 0xff, 0xb7, 0xf0, 0x4f, 0xee, 0x6f,
-  0xef, 0x2d, 0x9f, 0xcf, 0xbf, 0xef, 0xb7, 0x6f, 0x87, 0xdf, 0xcd, 0xff,
-  0xe6, 0xff, 0xef, 0xff, 0xfb, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x19, 0x01, 0x0b, 0x01, 0x07, 0x01, 0x0b, 0x01,
+  0x02, 0x01, 0x07, 0x05, 0x01, 0x02, 0x07, 0x01, 0x03, 0x02, 0x02, 0x01,
+  0x07, 0x01, 0x04, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x07, 0x02,
+  0x05, 0x01, 0x09, 0x01, 0x05, 0x01, 0x02, 0x01, 0x03, 0x01, 0x02, 0x01,
+  0x05, 0x04, 0x05, 0x01, 0x07, 0x02, 0x02, 0x01, 0x0c, 0x02, 0x02, 0x01,
+  0x0b, 0x01, 0x11, 0x01, 0x1a
 };
\ No newline at end of file
@@ -1,6 +1,8 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_sunny_overcast_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0x7f, 0xff, 0x7f, 0xf7, 0xe7, 0xfc, 0x3f, 0xf9, 0x9f,
-  0xfb, 0xdf, 0xd9, 0xdb, 0xf6, 0xdf, 0xe7, 0x3f, 0xef, 0xaf, 0xe0, 0x37,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x18, 0x01, 0x0f, 0x01, 0x0b, 0x01, 0x06, 0x02,
+  0x09, 0x04, 0x0b, 0x02, 0x02, 0x02, 0x0a, 0x01, 0x04, 0x01, 0x07, 0x01,
+  0x02, 0x02, 0x03, 0x01, 0x02, 0x01, 0x06, 0x01, 0x02, 0x01, 0x02, 0x01,
+  0x08, 0x02, 0x03, 0x02, 0x09, 0x01, 0x05, 0x01, 0x01, 0x01, 0x07, 0x07,
+  0x02, 0x01, 0x43
 };
\ No newline at end of file
@@ -1,6 +1,8 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_day_windy_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xbf, 0xfd, 0xfb, 0xfd, 0xb7, 0xfe, 0x4f, 0xfe, 0xef,
-  0xf7, 0xed, 0xfc, 0xef, 0xfe, 0x9f, 0x80, 0xf7, 0xff, 0xbf, 0x83, 0xbf,
-  0xfb, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x19, 0x01, 0x0c, 0x01, 0x06, 0x01, 0x08, 0x01,
+  0x02, 0x01, 0x02, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x0b, 0x01, 0x03, 0x01,
+  0x08, 0x01, 0x06, 0x01, 0x02, 0x01, 0x07, 0x02, 0x03, 0x01, 0x0b, 0x01,
+  0x01, 0x02, 0x06, 0x07, 0x04, 0x01, 0x0c, 0x01, 0x07, 0x05, 0x03, 0x01,
+  0x0b, 0x01, 0x0e, 0x01, 0x2b
 };
\ No newline at end of file
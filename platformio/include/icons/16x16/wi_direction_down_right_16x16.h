@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_direction_down_right_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff,
-  0xfc, 0xff, 0xfe, 0x1f, 0xff, 0x1f, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x55, 0x02, 0x0f, 0x02, 0x0f, 0x04, 0x0d, 0x03,
+  0x0c, 0x04, 0x65
 };
\ No newline at end of file
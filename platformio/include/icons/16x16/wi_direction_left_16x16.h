@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_direction_left_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff,
-  0xf9, 0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xf9, 0xff, 0xfd, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x56, 0x01, 0x0e, 0x02, 0x0d, 0x08, 0x08, 0x08,
+  0x09, 0x02, 0x0f, 0x01, 0x59
 };
\ No newline at end of file
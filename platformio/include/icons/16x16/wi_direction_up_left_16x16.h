@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_direction_up_left_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f,
-  0xf8, 0xff, 0xfa, 0x7f, 0xff, 0x3f, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x55, 0x04, 0x0c, 0x03, 0x0d, 0x01, 0x01, 0x02,
+  0x0f, 0x02, 0x0f, 0x01, 0x66
 };
\ No newline at end of file
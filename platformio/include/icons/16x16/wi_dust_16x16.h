@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_dust_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x1f,
-  0xff, 0xff, 0xfe, 0x5f, 0xf1, 0xcf, 0xff, 0xff, 0xfc, 0x9f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x54, 0x02, 0x01, 0x04, 0x1c, 0x02, 0x01, 0x01,
+  0x09, 0x03, 0x03, 0x02, 0x1a, 0x02, 0x01, 0x02, 0x55
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_earthquake_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbf, 0xfb, 0xbf, 0xfb, 0xbf,
-  0xfa, 0xbf, 0xf6, 0x7f, 0xfd, 0x4f, 0xfd, 0xdf, 0xfd, 0xdf, 0xfd, 0xdf,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x35, 0x01, 0x03, 0x01, 0x0b, 0x01, 0x03, 0x01,
+  0x0b, 0x01, 0x03, 0x01, 0x0b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0a, 0x01,
+  0x02, 0x02, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0a, 0x01, 0x03, 0x01,
+  0x0b, 0x01, 0x03, 0x01, 0x0b, 0x01, 0x03, 0x01, 0x45
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_fire_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0xbf,
-  0xf8, 0x1f, 0xfc, 0x1f, 0xf0, 0x1f, 0xf8, 0x1f, 0xff, 0xff, 0xf0, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x46, 0x02, 0x0e, 0x02, 0x01, 0x01, 0x0b, 0x06,
+  0x0b, 0x05, 0x09, 0x07, 0x0a, 0x06, 0x19, 0x08, 0x44
 };
\ No newline at end of file
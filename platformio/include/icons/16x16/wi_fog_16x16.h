@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_fog_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfb, 0x9f,
-  0xfb, 0xcf, 0xe7, 0xf7, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xc0, 0x0f,
-  0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x46, 0x04, 0x0b, 0x01, 0x03, 0x02, 0x0a, 0x01,
+  0x04, 0x02, 0x07, 0x02, 0x07, 0x01, 0x16, 0x0a, 0x15, 0x0a, 0x08, 0x0a,
+  0x32
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_gale_warning_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0x3f,
-  0xfc, 0x3f, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x46, 0x02, 0x0e, 0x04, 0x0c, 0x04, 0x0c, 0x02,
+  0x0e, 0x02, 0x0e, 0x04, 0x0c, 0x04, 0x0c, 0x02, 0x48
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_horizon_alt_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xf7, 0xef,
-  0xfc, 0x3f, 0xfb, 0xdf, 0xcb, 0xd3, 0xfb, 0xdf, 0xff, 0xff, 0xe0, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x44, 0x01, 0x06, 0x01, 0x08, 0x01, 0x06, 0x01,
+  0x0a, 0x04, 0x0b, 0x01, 0x04, 0x01, 0x07, 0x02, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x02, 0x07, 0x01, 0x04, 0x01, 0x18, 0x0a, 0x43
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_hot_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xfe, 0x7f,
-  0xfd, 0xbf, 0xeb, 0xd7, 0xff, 0xff, 0xfa, 0xbf, 0xf9, 0x5f, 0xfd, 0x5f,
-  0xfd, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x44, 0x01, 0x06, 0x01, 0x0b, 0x02, 0x0d, 0x01,
+  0x02, 0x01, 0x09, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x18, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x0b, 0x02, 0x01, 0x01, 0x01, 0x01, 0x0b, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x0b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x35
 };
\ No newline at end of file
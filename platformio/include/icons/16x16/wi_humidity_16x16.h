@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_humidity_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f,
-  0xfa, 0x5f, 0xf4, 0x9f, 0xf6, 0x8f, 0xf1, 0x6f, 0xf1, 0x6f, 0xf8, 0x5f,
-  0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x37, 0x02, 0x0e, 0x02, 0x0d, 0x04, 0x0b, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x09, 0x01, 0x01, 0x02, 0x01, 0x02, 0x09, 0x01,
+  0x02, 0x01, 0x01, 0x03, 0x08, 0x03, 0x01, 0x01, 0x02, 0x01, 0x08, 0x03,
+  0x01, 0x01, 0x02, 0x01, 0x09, 0x04, 0x01, 0x01, 0x0b, 0x04, 0x36
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_hurricane_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff,
-  0xfc, 0x3f, 0xfd, 0xbf, 0xfd, 0xbf, 0xfe, 0x3f, 0xff, 0x7f, 0xfe, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x47, 0x01, 0x0f, 0x01, 0x0e, 0x04, 0x0c, 0x01,
+  0x02, 0x01, 0x0c, 0x01, 0x02, 0x01, 0x0d, 0x03, 0x0e, 0x01, 0x0e, 0x01,
+  0x48
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_hurricane_warning_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xf1, 0x3f,
-  0xf0, 0x3f, 0xf4, 0x7f, 0xf0, 0x3f, 0xf3, 0x3f, 0xf0, 0x3f, 0xf7, 0xff,
-  0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x44, 0x06, 0x0a, 0x03, 0x01, 0x02, 0x0a, 0x06,
+  0x0a, 0x01, 0x01, 0x03, 0x0b, 0x06, 0x0a, 0x02, 0x02, 0x02, 0x0a, 0x06,
+  0x0a, 0x01, 0x0f, 0x01, 0x3b
 };
\ No newline at end of file
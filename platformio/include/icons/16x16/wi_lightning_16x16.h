@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_lightning_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfc, 0x9f, 0xf8, 0x9f,
-  0xf9, 0xdf, 0xf9, 0xff, 0xf8, 0xbf, 0xfd, 0xff, 0xfb, 0xff, 0xfb, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x3a, 0x01, 0x0b, 0x02, 0x01, 0x02, 0x0a, 0x03,
+  0x01, 0x02, 0x0a, 0x02, 0x03, 0x01, 0x0a, 0x02, 0x0e, 0x03, 0x01, 0x01,
+  0x0c, 0x01, 0x0e, 0x01, 0x0f, 0x01, 0x4a
 };
\ No newline at end of file
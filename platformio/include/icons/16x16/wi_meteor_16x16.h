@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_meteor_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xfe, 0x1f,
-  0xfc, 0x1f, 0xf8, 0x1f, 0xfa, 0x1f, 0xf7, 0x3f, 0xff, 0xff, 0xf7, 0x7f,
-  0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x3a, 0x01, 0x0e, 0x01, 0x0d, 0x04, 0x0b, 0x05,
+  0x0a, 0x06, 0x0a, 0x01, 0x01, 0x04, 0x09, 0x01, 0x03, 0x02, 0x1a, 0x01,
+  0x03, 0x01, 0x0c, 0x03, 0x38
 };
\ No newline at end of file
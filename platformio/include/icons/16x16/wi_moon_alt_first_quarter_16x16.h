@@ -1,6 +1,8 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_alt_first_quarter_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x9f, 0xf0, 0xef, 0xe0, 0xf7, 0xc0, 0xfb,
-  0xc0, 0xfb, 0xc0, 0xfb, 0xc0, 0xfb, 0xc0, 0xfb, 0xe0, 0xff, 0xe0, 0xf7,
-  0xf0, 0xcf, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x25, 0x03, 0x01, 0x02, 0x09, 0x04, 0x03, 0x01,
+  0x07, 0x05, 0x04, 0x01, 0x05, 0x06, 0x05, 0x01, 0x04, 0x06, 0x05, 0x01,
+  0x04, 0x06, 0x05, 0x01, 0x04, 0x06, 0x05, 0x01, 0x04, 0x06, 0x05, 0x01,
+  0x05, 0x05, 0x0b, 0x05, 0x04, 0x01, 0x07, 0x04, 0x02, 0x02, 0x0b, 0x02,
+  0x27
 };
\ No newline at end of file
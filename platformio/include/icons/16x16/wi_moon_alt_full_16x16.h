@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_alt_full_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf9, 0x9f, 0xf7, 0xef, 0xef, 0xf7, 0xdf, 0xfb,
-  0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xff, 0xff, 0xef, 0xf7,
-  0xf3, 0xcf, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x25, 0x02, 0x02, 0x02, 0x09, 0x01, 0x06, 0x01,
+  0x07, 0x01, 0x08, 0x01, 0x05, 0x01, 0x0a, 0x01, 0x04, 0x01, 0x0a, 0x01,
+  0x04, 0x01, 0x0a, 0x01, 0x04, 0x01, 0x0a, 0x01, 0x04, 0x01, 0x0a, 0x01,
+  0x15, 0x01, 0x08, 0x01, 0x07, 0x02, 0x04, 0x02, 0x0b, 0x02, 0x27
 };
\ No newline at end of file
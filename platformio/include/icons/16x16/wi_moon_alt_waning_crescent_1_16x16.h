@@ -1,6 +1,8 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_alt_waning_crescent_1_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf9, 0x1f, 0xf7, 0x0f, 0xef, 0x07, 0xdf, 0x03,
-  0xdf, 0x03, 0xdf, 0x03, 0xdf, 0x03, 0xdf, 0x03, 0xff, 0x07, 0xef, 0x07,
-  0xf3, 0x0f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x25, 0x02, 0x01, 0x03, 0x09, 0x01, 0x03, 0x04,
+  0x07, 0x01, 0x04, 0x05, 0x05, 0x01, 0x05, 0x06, 0x04, 0x01, 0x05, 0x06,
+  0x04, 0x01, 0x05, 0x06, 0x04, 0x01, 0x05, 0x06, 0x04, 0x01, 0x05, 0x06,
+  0x0a, 0x05, 0x06, 0x01, 0x04, 0x05, 0x07, 0x02, 0x02, 0x04, 0x0b, 0x02,
+  0x27
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_alt_waning_crescent_3_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xf6, 0x0f, 0xee, 0x07, 0xde, 0x03,
-  0xde, 0x03, 0xde, 0x03, 0xde, 0x03, 0xde, 0x03, 0xfe, 0x07, 0xee, 0x07,
-  0xf3, 0x0f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x25, 0x06, 0x09, 0x01, 0x02, 0x05, 0x07, 0x01,
+  0x03, 0x06, 0x05, 0x01, 0x04, 0x07, 0x04, 0x01, 0x04, 0x07, 0x04, 0x01,
+  0x04, 0x07, 0x04, 0x01, 0x04, 0x07, 0x04, 0x01, 0x04, 0x07, 0x09, 0x06,
+  0x06, 0x01, 0x03, 0x06, 0x07, 0x02, 0x02, 0x04, 0x0b, 0x02, 0x27
 };
\ No newline at end of file
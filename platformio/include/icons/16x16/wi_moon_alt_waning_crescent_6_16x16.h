@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_alt_waning_crescent_6_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xf4, 0x0f, 0xe8, 0x07, 0xd8, 0x03,
-  0xd0, 0x03, 0xd0, 0x03, 0xd0, 0x03, 0xd8, 0x03, 0xf8, 0x07, 0xe8, 0x07,
-  0xf0, 0x0f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x25, 0x06, 0x09, 0x01, 0x01, 0x06, 0x07, 0x01,
+  0x01, 0x08, 0x05, 0x01, 0x02, 0x09, 0x04, 0x01, 0x01, 0x0a, 0x04, 0x01,
+  0x01, 0x0a, 0x04, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x02, 0x09, 0x07, 0x08,
+  0x06, 0x01, 0x01, 0x08, 0x07, 0x08, 0x0b, 0x02, 0x27
 };
\ No newline at end of file
@@ -1,6 +1,8 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_alt_waning_gibbous_5_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf9, 0x1f, 0xf7, 0x8f, 0xef, 0x87, 0xdf, 0x83,
-  0xdf, 0x83, 0xdf, 0x83, 0xdf, 0x83, 0xdf, 0x83, 0xff, 0x87, 0xef, 0x87,
-  0xf3, 0x8f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x25, 0x02, 0x01, 0x03, 0x09, 0x01, 0x04, 0x03,
+  0x07, 0x01, 0x05, 0x04, 0x05, 0x01, 0x06, 0x05, 0x04, 0x01, 0x06, 0x05,
+  0x04, 0x01, 0x06, 0x05, 0x04, 0x01, 0x06, 0x05, 0x04, 0x01, 0x06, 0x05,
+  0x0b, 0x04, 0x06, 0x01, 0x05, 0x04, 0x07, 0x02, 0x03, 0x03, 0x0b, 0x02,
+  0x27
 };
\ No newline at end of file
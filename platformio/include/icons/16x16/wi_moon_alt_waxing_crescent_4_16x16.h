@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_alt_waxing_crescent_4_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xf0, 0x6f, 0xe0, 0x77, 0xc0, 0x3b,
-  0xc0, 0x3b, 0xc0, 0x3b, 0xc0, 0x3b, 0xc0, 0x3b, 0xe0, 0x3f, 0xe0, 0x77,
-  0xf0, 0x4f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x25, 0x06, 0x09, 0x05, 0x02, 0x01, 0x07, 0x06,
+  0x03, 0x01, 0x05, 0x08, 0x03, 0x01, 0x04, 0x08, 0x03, 0x01, 0x04, 0x08,
+  0x03, 0x01, 0x04, 0x08, 0x03, 0x01, 0x04, 0x08, 0x03, 0x01, 0x05, 0x07,
+  0x09, 0x06, 0x03, 0x01, 0x07, 0x05, 0x01, 0x02, 0x0b, 0x02, 0x27
 };
\ No newline at end of file
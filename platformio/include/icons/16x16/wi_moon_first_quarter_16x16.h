@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_first_quarter_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0x0f, 0xff, 0x07, 0xff, 0x03,
-  0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x07, 0xff, 0x07,
-  0xff, 0x0f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x28, 0x03, 0x0d, 0x04, 0x0c, 0x05, 0x0b, 0x06,
+  0x0a, 0x06, 0x0a, 0x06, 0x0a, 0x06, 0x0a, 0x06, 0x0a, 0x05, 0x0b, 0x05,
+  0x0b, 0x04, 0x0c, 0x01, 0x27
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_waning_crescent_2_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf1, 0xff, 0xe1, 0xff, 0xc1, 0xff,
-  0xc3, 0xff, 0xc3, 0xff, 0xc3, 0xff, 0xc1, 0xff, 0xe1, 0xff, 0xe1, 0xff,
-  0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x25, 0x03, 0x0c, 0x03, 0x0c, 0x04, 0x0b, 0x05,
+  0x0b, 0x04, 0x0c, 0x04, 0x0c, 0x04, 0x0c, 0x05, 0x0c, 0x04, 0x0c, 0x04,
+  0x0d, 0x03, 0x39
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_waning_crescent_4_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf3, 0xff, 0xe3, 0xff, 0xc7, 0xff,
-  0xc7, 0xff, 0xc7, 0xff, 0xc7, 0xff, 0xc7, 0xff, 0xe7, 0xff, 0xe3, 0xff,
-  0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x25, 0x02, 0x0d, 0x02, 0x0d, 0x03, 0x0c, 0x03,
+  0x0d, 0x03, 0x0d, 0x03, 0x0d, 0x03, 0x0d, 0x03, 0x0e, 0x02, 0x0e, 0x03,
+  0x0e, 0x02, 0x3a
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_waning_crescent_6_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xcf, 0xff,
-  0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xcf, 0xff, 0xef, 0xff, 0xe7, 0xff,
-  0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x25, 0x01, 0x0e, 0x01, 0x0e, 0x01, 0x0e, 0x02,
+  0x0e, 0x01, 0x0f, 0x01, 0x0f, 0x01, 0x0f, 0x02, 0x0f, 0x01, 0x0f, 0x02,
+  0x0f, 0x02, 0x3a
 };
\ No newline at end of file
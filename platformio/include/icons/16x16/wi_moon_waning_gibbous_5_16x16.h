@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_waning_gibbous_5_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf0, 0x7f, 0xe0, 0x7f, 0xc0, 0x7f,
-  0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xe0, 0x7f, 0xe0, 0x7f,
-  0xf0, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x25, 0x03, 0x0c, 0x05, 0x0a, 0x06, 0x09, 0x07,
+  0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x06, 0x0a, 0x06,
+  0x0b, 0x05, 0x0e, 0x01, 0x28
 };
\ No newline at end of file
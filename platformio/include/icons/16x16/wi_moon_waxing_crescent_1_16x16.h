@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_waxing_crescent_1_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xef, 0xff, 0xe7, 0xff, 0xf3,
-  0xff, 0xf3, 0xff, 0xf3, 0xff, 0xf3, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xe7,
-  0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x29, 0x02, 0x10, 0x01, 0x0f, 0x02, 0x0f, 0x02,
+  0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x01, 0x0e, 0x02,
+  0x0d, 0x02, 0x34
 };
\ No newline at end of file
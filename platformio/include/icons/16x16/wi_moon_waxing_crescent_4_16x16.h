@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_waxing_crescent_4_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x8f, 0xff, 0xc7, 0xff, 0xc3,
-  0xff, 0xc3, 0xff, 0xc3, 0xff, 0xc3, 0xff, 0xc3, 0xff, 0xc7, 0xff, 0x87,
-  0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x29, 0x02, 0x0e, 0x03, 0x0e, 0x03, 0x0d, 0x04,
+  0x0c, 0x04, 0x0c, 0x04, 0x0c, 0x04, 0x0c, 0x04, 0x0c, 0x03, 0x0c, 0x04,
+  0x0c, 0x03, 0x34
 };
\ No newline at end of file
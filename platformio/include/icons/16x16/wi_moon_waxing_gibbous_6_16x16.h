@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moon_waxing_gibbous_6_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xfc, 0x0f, 0xf8, 0x07, 0xf8, 0x03,
-  0xf8, 0x03, 0xf8, 0x03, 0xf8, 0x03, 0xf8, 0x03, 0xf8, 0x07, 0xf8, 0x07,
-  0xfc, 0x0f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x27, 0x04, 0x0b, 0x06, 0x09, 0x08, 0x08, 0x09,
+  0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x08, 0x08, 0x08,
+  0x09, 0x06, 0x0c, 0x01, 0x27
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_moonset_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfb, 0x7f,
-  0xf3, 0xbf, 0xf7, 0xcf, 0xf7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f,
-  0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x46, 0x03, 0x0c, 0x01, 0x02, 0x01, 0x0b, 0x02,
+  0x03, 0x01, 0x0a, 0x01, 0x05, 0x02, 0x08, 0x01, 0x06, 0x01, 0x29, 0x06,
+  0x0c, 0x02, 0x37
 };
\ No newline at end of file
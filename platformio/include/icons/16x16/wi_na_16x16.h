@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_na_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf5, 0x5f, 0xf1, 0x0f, 0xf1, 0x8f, 0xf4, 0xaf, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x64, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x09, 0x03, 0x01, 0x04, 0x08, 0x03, 0x02, 0x03, 0x08, 0x01, 0x01, 0x02,
+  0x01, 0x01, 0x01, 0x01, 0x64
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_alt_cloudy_gusts_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xfc, 0x37, 0xfb, 0x93,
-  0xfb, 0xcb, 0xe6, 0x73, 0xff, 0x7b, 0xc0, 0x7b, 0xff, 0xf7, 0xc3, 0x0f,
-  0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x3a, 0x03, 0x09, 0x04, 0x02, 0x01, 0x08, 0x01,
+  0x03, 0x02, 0x01, 0x02, 0x07, 0x01, 0x04, 0x02, 0x01, 0x01, 0x05, 0x02,
+  0x02, 0x02, 0x03, 0x02, 0x0a, 0x01, 0x04, 0x01, 0x04, 0x07, 0x04, 0x01,
+  0x0e, 0x01, 0x05, 0x04, 0x02, 0x04, 0x09, 0x01, 0x0f, 0x01, 0x2a
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_alt_cloudy_windy_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xfe, 0x17, 0xfd, 0xdb,
-  0xfb, 0xc9, 0xf7, 0xf3, 0xff, 0xfb, 0xe0, 0xfb, 0xff, 0xf3, 0xc1, 0x0f,
-  0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x3a, 0x03, 0x0a, 0x04, 0x01, 0x01, 0x09, 0x01,
+  0x03, 0x01, 0x02, 0x01, 0x07, 0x01, 0x04, 0x02, 0x01, 0x02, 0x05, 0x01,
+  0x07, 0x02, 0x0f, 0x01, 0x05, 0x05, 0x05, 0x01, 0x0e, 0x02, 0x04, 0x05,
+  0x01, 0x04, 0x08, 0x05, 0x37
 };
\ No newline at end of file
@@ -1,6 +1,8 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_alt_hail_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xfc, 0x2f, 0xfb, 0xb7,
-  0xf7, 0x93, 0xef, 0xe7, 0xdf, 0xf7, 0xdd, 0xf7, 0xec, 0xa7, 0xfe, 0xbf,
-  0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x39, 0x03, 0x0a, 0x04, 0x01, 0x01, 0x09, 0x01,
+  0x03, 0x01, 0x02, 0x01, 0x07, 0x01, 0x04, 0x02, 0x01, 0x02, 0x05, 0x01,
+  0x07, 0x02, 0x05, 0x01, 0x09, 0x01, 0x05, 0x01, 0x03, 0x01, 0x05, 0x01,
+  0x06, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x0a, 0x01, 0x01, 0x01,
+  0x0b, 0x01, 0x01, 0x01, 0x38
 };
\ No newline at end of file
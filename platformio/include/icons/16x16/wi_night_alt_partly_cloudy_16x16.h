@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_alt_partly_cloudy_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfe, 0xbf,
-  0xfd, 0xdf, 0xfc, 0xcf, 0xfb, 0x6f, 0xf3, 0x9f, 0xf7, 0xdf, 0xf0, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x48, 0x02, 0x0d, 0x01, 0x01, 0x01, 0x0c, 0x01,
+  0x03, 0x01, 0x0b, 0x02, 0x02, 0x02, 0x09, 0x01, 0x02, 0x01, 0x02, 0x01,
+  0x08, 0x02, 0x03, 0x02, 0x09, 0x01, 0x05, 0x01, 0x09, 0x07, 0x45
 };
\ No newline at end of file
@@ -1,6 +1,8 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_alt_rain_wind_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xfc, 0x2f, 0xfb, 0xb7,
-  0xf7, 0x93, 0xef, 0xe7, 0xdf, 0xf7, 0xdf, 0xf7, 0xed, 0x67, 0xf9, 0x5f,
-  0xfe, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x39, 0x03, 0x0a, 0x04, 0x01, 0x01, 0x09, 0x01,
+  0x03, 0x01, 0x02, 0x01, 0x07, 0x01, 0x04, 0x02, 0x01, 0x02, 0x05, 0x01,
+  0x07, 0x02, 0x05, 0x01, 0x09, 0x01, 0x05, 0x01, 0x09, 0x01, 0x06, 0x01,
+  0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x08, 0x02, 0x01, 0x01, 0x01, 0x01,
+  0x0c, 0x01, 0x01, 0x01, 0x0a, 0x01, 0x2b
 };
\ No newline at end of file
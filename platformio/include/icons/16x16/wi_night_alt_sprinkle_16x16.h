@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_alt_sprinkle_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xfc, 0x2f, 0xfb, 0xb7,
-  0xf7, 0xd3, 0xef, 0xe7, 0xdf, 0xf7, 0xd9, 0xf7, 0xee, 0x67, 0xfe, 0x7f,
-  0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x39, 0x03, 0x0a, 0x04, 0x01, 0x01, 0x09, 0x01,
+  0x03, 0x01, 0x02, 0x01, 0x07, 0x01, 0x05, 0x01, 0x01, 0x02, 0x05, 0x01,
+  0x07, 0x02, 0x05, 0x01, 0x09, 0x01, 0x05, 0x01, 0x02, 0x02, 0x05, 0x01,
+  0x06, 0x01, 0x03, 0x02, 0x02, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x37
 };
\ No newline at end of file
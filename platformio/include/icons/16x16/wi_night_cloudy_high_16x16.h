@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_cloudy_high_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf3, 0x3f, 0xf7, 0xbf, 0xef, 0xef,
-  0xdf, 0xf7, 0xdf, 0xf7, 0xcf, 0xe3, 0xe0, 0x0b, 0xff, 0x7b, 0xff, 0xb3,
-  0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x26, 0x03, 0x0b, 0x02, 0x02, 0x02, 0x0a, 0x01,
+  0x04, 0x01, 0x09, 0x01, 0x07, 0x01, 0x06, 0x01, 0x09, 0x01, 0x05, 0x01,
+  0x09, 0x01, 0x05, 0x02, 0x07, 0x03, 0x05, 0x09, 0x01, 0x01, 0x0a, 0x01,
+  0x04, 0x01, 0x0b, 0x01, 0x02, 0x02, 0x0c, 0x02, 0x34
 };
\ No newline at end of file
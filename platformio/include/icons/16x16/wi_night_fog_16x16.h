@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_fog_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xfc, 0x37, 0xfb, 0x93,
-  0xf3, 0xcb, 0xe7, 0xf3, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xc0, 0x0f,
-  0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x3a, 0x03, 0x09, 0x04, 0x02, 0x01, 0x08, 0x01,
+  0x03, 0x02, 0x01, 0x02, 0x06, 0x02, 0x04, 0x02, 0x01, 0x01, 0x05, 0x02,
+  0x07, 0x02, 0x15, 0x0a, 0x15, 0x0a, 0x08, 0x0a, 0x32
 };
\ No newline at end of file
@@ -1,6 +1,8 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_lightning_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xfc, 0x37, 0xfb, 0xbb,
-  0xf7, 0xdb, 0xef, 0xe7, 0xdf, 0x77, 0xde, 0x77, 0xee, 0xf7, 0xf6, 0x7f,
-  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x3a, 0x02, 0x0a, 0x04, 0x02, 0x01, 0x08, 0x01,
+  0x03, 0x01, 0x03, 0x01, 0x06, 0x01, 0x05, 0x01, 0x02, 0x01, 0x05, 0x01,
+  0x07, 0x02, 0x05, 0x01, 0x05, 0x01, 0x03, 0x01, 0x05, 0x01, 0x04, 0x02,
+  0x03, 0x01, 0x06, 0x01, 0x03, 0x01, 0x04, 0x01, 0x07, 0x01, 0x02, 0x02,
+  0x0e, 0x01, 0x38
 };
\ No newline at end of file
@@ -1,6 +1,9 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_night_thunderstorm_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfc, 0x37, 0xfb, 0xbb,
-  0xf7, 0xdb, 0xef, 0xe7, 0xdf, 0xf7, 0xd9, 0x77, 0xe3, 0xa7, 0xf2, 0xaf,
-  0xf2, 0xbf, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x3a, 0x01, 0x0b, 0x04, 0x02, 0x01, 0x08, 0x01,
+  0x03, 0x01, 0x03, 0x01, 0x06, 0x01, 0x05, 0x01, 0x02, 0x01, 0x05, 0x01,
+  0x07, 0x02, 0x05, 0x01, 0x09, 0x01, 0x05, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x03, 0x01, 0x06, 0x03, 0x03, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x08, 0x02, 0x01, 0x01, 0x01, 0x01, 0x0b, 0x01,
+  0x01, 0x01, 0x28
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_raindrops_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x9f, 0xfb, 0xff,
-  0xf1, 0xff, 0xf1, 0xbf, 0xff, 0x1f, 0xff, 0x1f, 0xfe, 0x0f, 0xfe, 0x0f,
-  0xff, 0x0f, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x39, 0x01, 0x0f, 0x02, 0x0a, 0x01, 0x0e, 0x03,
+  0x0d, 0x03, 0x02, 0x01, 0x0e, 0x03, 0x0d, 0x03, 0x0c, 0x05, 0x0b, 0x05,
+  0x0c, 0x04, 0x0d, 0x01, 0x26
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_refresh_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f,
-  0xfc, 0x7f, 0xfb, 0xff, 0xfb, 0xdf, 0xfd, 0xbf, 0xfc, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x57, 0x02, 0x0d, 0x03, 0x0c, 0x01, 0x0f, 0x01,
+  0x04, 0x01, 0x0b, 0x01, 0x02, 0x01, 0x0c, 0x04, 0x56
 };
\ No newline at end of file
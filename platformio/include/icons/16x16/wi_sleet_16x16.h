@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_sleet_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfb, 0xbf,
-  0xf7, 0x9f, 0xef, 0xe7, 0xdf, 0xf7, 0xdf, 0xf7, 0xef, 0xe7, 0xf6, 0xef,
-  0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x46, 0x03, 0x0c, 0x01, 0x03, 0x01, 0x0a, 0x01,
+  0x04, 0x02, 0x08, 0x01, 0x07, 0x02, 0x05, 0x01, 0x09, 0x01, 0x05, 0x01,
+  0x09, 0x01, 0x06, 0x01, 0x07, 0x02, 0x07, 0x01, 0x02, 0x01, 0x03, 0x01,
+  0x09, 0x01, 0x3a
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_smog_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xf8, 0x3f, 0xf0, 0x0f,
-  0xe0, 0x07, 0xf0, 0x0f, 0xf8, 0x0f, 0xfe, 0x1f, 0xfe, 0x3f, 0xff, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x36, 0x04, 0x0b, 0x05, 0x0a, 0x08, 0x07, 0x0a,
+  0x07, 0x08, 0x09, 0x07, 0x0b, 0x04, 0x0c, 0x03, 0x0e, 0x02, 0x46
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_smoke_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xbf, 0xfb, 0xbf, 0xf7, 0xef,
-  0xef, 0xff, 0xf7, 0xff, 0xf9, 0xef, 0xfe, 0x1f, 0xfe, 0x3f, 0xff, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x36, 0x01, 0x02, 0x01, 0x0b, 0x01, 0x03, 0x01,
+  0x0a, 0x01, 0x06, 0x01, 0x07, 0x01, 0x10, 0x01, 0x10, 0x02, 0x04, 0x01,
+  0x0b, 0x04, 0x0c, 0x03, 0x0e, 0x01, 0x47
 };
\ No newline at end of file
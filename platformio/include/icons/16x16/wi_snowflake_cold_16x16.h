@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_snowflake_cold_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x3f, 0xf8, 0x1f, 0xfe, 0x7f, 0xfd, 0xbf, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x66, 0x04, 0x0b, 0x06, 0x0c, 0x02, 0x0d, 0x01,
+  0x02, 0x01, 0x66
 };
\ No newline at end of file
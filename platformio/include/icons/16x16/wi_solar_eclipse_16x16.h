@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_solar_eclipse_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xfe, 0x7f,
-  0xfc, 0x3f, 0xe8, 0x57, 0xf8, 0x5f, 0xfc, 0x3f, 0xfe, 0x7f, 0xf7, 0xef,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x44, 0x01, 0x06, 0x01, 0x0b, 0x02, 0x0d, 0x04,
+  0x09, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x08, 0x04, 0x01, 0x01,
+  0x0b, 0x04, 0x0d, 0x02, 0x0b, 0x01, 0x06, 0x01, 0x44
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_stars_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xfd, 0xff,
-  0xff, 0xff, 0xff, 0xef, 0xf7, 0xef, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x36, 0x01, 0x0e, 0x03, 0x0e, 0x01, 0x24, 0x01,
+  0x08, 0x01, 0x06, 0x01, 0x1b, 0x02, 0x0e, 0x01, 0x48
 };
\ No newline at end of file
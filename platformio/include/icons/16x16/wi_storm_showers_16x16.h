@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_storm_showers_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfb, 0xbf,
-  0xf7, 0xcf, 0xef, 0xf7, 0xef, 0xf7, 0xf9, 0xd7, 0xe3, 0xf7, 0xf3, 0xef,
-  0xf3, 0xbf, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x46, 0x03, 0x0c, 0x01, 0x03, 0x01, 0x0a, 0x01,
+  0x05, 0x02, 0x07, 0x01, 0x08, 0x01, 0x06, 0x01, 0x08, 0x01, 0x08, 0x02,
+  0x03, 0x01, 0x01, 0x01, 0x06, 0x03, 0x06, 0x01, 0x07, 0x02, 0x05, 0x01,
+  0x08, 0x02, 0x03, 0x01, 0x0b, 0x01, 0x01, 0x01, 0x28
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_strong_wind_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-  0xff, 0xfb, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0x9f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x5c, 0x02, 0x0f, 0x01, 0x04, 0x0c, 0x14, 0x09,
+  0x0e, 0x02, 0x55
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_sunrise_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xf7, 0xef, 0xfc, 0x3f,
-  0xf9, 0x9f, 0xfb, 0xdf, 0xdb, 0xdb, 0xfa, 0x5f, 0xfc, 0x3f, 0xf9, 0x9f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x27, 0x02, 0x1b, 0x01, 0x06, 0x01, 0x0a, 0x04,
+  0x0b, 0x02, 0x02, 0x02, 0x0a, 0x01, 0x04, 0x01, 0x07, 0x01, 0x02, 0x01,
+  0x04, 0x01, 0x02, 0x01, 0x07, 0x01, 0x01, 0x02, 0x01, 0x01, 0x0b, 0x04,
+  0x0b, 0x02, 0x02, 0x02, 0x45
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_sunset_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xf7, 0xef, 0xfe, 0x7f,
-  0xf9, 0x9f, 0xfb, 0xdf, 0xcb, 0xd3, 0xfb, 0xdf, 0xff, 0xff, 0xf8, 0x1f,
-  0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x28, 0x01, 0x1b, 0x01, 0x06, 0x01, 0x0b, 0x02,
+  0x0c, 0x02, 0x02, 0x02, 0x0a, 0x01, 0x04, 0x01, 0x07, 0x02, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x02, 0x07, 0x01, 0x04, 0x01, 0x1a, 0x06, 0x0c, 0x02,
+  0x37
 };
\ No newline at end of file
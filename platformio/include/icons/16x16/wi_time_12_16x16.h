@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_time_12_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xf3, 0xcf, 0xe7, 0xe7, 0xcf, 0xf3,
-  0xcf, 0xf3, 0xdf, 0xfb, 0xdf, 0xfb, 0xcf, 0xf3, 0xef, 0xf7, 0xe7, 0xe7,
-  0xf0, 0x0f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x25, 0x06, 0x09, 0x02, 0x04, 0x02, 0x07, 0x02,
+  0x06, 0x02, 0x05, 0x02, 0x08, 0x02, 0x04, 0x02, 0x08, 0x02, 0x04, 0x01,
+  0x0a, 0x01, 0x04, 0x01, 0x0a, 0x01, 0x04, 0x02, 0x08, 0x02, 0x05, 0x01,
+  0x08, 0x01, 0x06, 0x02, 0x06, 0x02, 0x07, 0x08, 0x0b, 0x02, 0x27
 };
\ No newline at end of file
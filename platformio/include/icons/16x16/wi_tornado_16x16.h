@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_tornado_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xef, 0xf3, 0xe7, 0xf3, 0xe8, 0x0f,
-  0xef, 0xcf, 0xe0, 0x3f, 0xcf, 0x3f, 0xe0, 0xff, 0xec, 0xff, 0xf1, 0xff,
-  0xe5, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x24, 0x09, 0x06, 0x01, 0x08, 0x02, 0x05, 0x02,
+  0x07, 0x02, 0x05, 0x01, 0x01, 0x07, 0x07, 0x01, 0x06, 0x02, 0x07, 0x07,
+  0x08, 0x02, 0x04, 0x02, 0x09, 0x05, 0x0b, 0x01, 0x02, 0x02, 0x0c, 0x03,
+  0x0c, 0x02, 0x01, 0x01, 0x0d, 0x02, 0x2a
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_train_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf,
-  0xe3, 0xbf, 0xeb, 0x9f, 0xf8, 0x0f, 0xe0, 0x0f, 0xe0, 0x0f, 0xe4, 0x07,
-  0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x29, 0x02, 0x0e, 0x02, 0x0e, 0x01, 0x0f, 0x01,
+  0x09, 0x03, 0x03, 0x01, 0x09, 0x01, 0x01, 0x01, 0x03, 0x02, 0x0a, 0x07,
+  0x07, 0x09, 0x07, 0x09, 0x07, 0x02, 0x01, 0x07, 0x0f, 0x01, 0x33
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_umbrella_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfb, 0xdf, 0xf7, 0xef,
-  0xef, 0xf7, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
-  0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x37, 0x02, 0x0c, 0x01, 0x04, 0x01, 0x09, 0x01,
+  0x06, 0x01, 0x07, 0x01, 0x08, 0x01, 0x06, 0x0a, 0x38, 0x01, 0x10, 0x02,
+  0x38
 };
\ No newline at end of file
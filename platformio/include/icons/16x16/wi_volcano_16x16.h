@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_volcano_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xfe, 0x7f,
-  0xfe, 0xff, 0xff, 0x7f, 0xfe, 0x7f, 0xfc, 0xbf, 0xf8, 0x9f, 0xf0, 0x8f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x27, 0x01, 0x0e, 0x04, 0x0c, 0x04, 0x0d, 0x02,
+  0x0e, 0x01, 0x10, 0x01, 0x0e, 0x02, 0x0d, 0x02, 0x01, 0x01, 0x0b, 0x03,
+  0x01, 0x02, 0x09, 0x04, 0x01, 0x03, 0x44
 };
\ No newline at end of file
@@ -1,6 +1,9 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_wind_0deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xf0, 0x0f, 0xe7, 0xe7, 0xed, 0xb7,
-  0xcc, 0x33, 0xde, 0x7b, 0xde, 0x7b, 0xce, 0x73, 0xce, 0x73, 0xe7, 0xe7,
-  0xf3, 0xcf, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x26, 0x04, 0x0a, 0x08, 0x07, 0x02, 0x06, 0x02,
+  0x06, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x05, 0x02, 0x02, 0x04,
+  0x02, 0x02, 0x04, 0x01, 0x04, 0x02, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02,
+  0x04, 0x01, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x04, 0x02, 0x09, 0x06,
+  0x25
 };
\ No newline at end of file
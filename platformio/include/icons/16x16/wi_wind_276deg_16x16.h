@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wi_wind_276deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xf1, 0x8f, 0xe7, 0xe7, 0xef, 0xf3,
-  0xc8, 0xfb, 0xcc, 0x3b, 0xc8, 0x0b, 0xcb, 0xfb, 0xef, 0xf3, 0xe7, 0xe7,
-  0xf1, 0xcf, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
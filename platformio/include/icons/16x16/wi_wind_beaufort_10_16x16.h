@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_wind_beaufort_10_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
-  0xc1, 0xff, 0xc0, 0xff, 0xfe, 0xa3, 0xff, 0xab, 0xff, 0xab, 0xff, 0xb7,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x59, 0x01, 0x08, 0x05, 0x0b, 0x06, 0x0f, 0x01,
+  0x01, 0x01, 0x01, 0x03, 0x0b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0b, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x0b, 0x01, 0x02, 0x01, 0x43
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_wind_beaufort_1_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-  0xf0, 0x7f, 0xf0, 0x2f, 0xff, 0xef, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xdf,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x5b, 0x01, 0x08, 0x05, 0x0b, 0x06, 0x01, 0x01,
+  0x0f, 0x01, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x01, 0x45
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_wind_beaufort_3_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf,
-  0xe0, 0x7f, 0xe0, 0x6f, 0xff, 0x47, 0xff, 0xe7, 0xff, 0xd7, 0xff, 0xef,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x5a, 0x01, 0x08, 0x06, 0x0a, 0x06, 0x02, 0x01,
+  0x0c, 0x01, 0x01, 0x03, 0x0e, 0x02, 0x0d, 0x01, 0x01, 0x01, 0x0e, 0x01,
+  0x44
 };
\ No newline at end of file
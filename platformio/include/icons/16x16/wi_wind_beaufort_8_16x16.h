@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_wind_beaufort_8_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf,
-  0xe0, 0xff, 0xe0, 0x6f, 0xff, 0x57, 0xff, 0xc7, 0xff, 0xd7, 0xff, 0xcf,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x5a, 0x01, 0x08, 0x05, 0x0b, 0x06, 0x02, 0x01,
+  0x0c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0d, 0x03, 0x0d, 0x01, 0x01, 0x01,
+  0x0d, 0x02, 0x44
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wi_wind_beaufort_9_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf,
-  0xe0, 0x7f, 0xe0, 0x7f, 0xff, 0x47, 0xff, 0xc7, 0xff, 0xc7, 0xff, 0xcf,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x5a, 0x01, 0x08, 0x06, 0x0a, 0x06, 0x0f, 0x01,
+  0x01, 0x03, 0x0d, 0x03, 0x0d, 0x03, 0x0d, 0x02, 0x44
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wifi_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xe7, 0xe7, 0x9f, 0xf9,
-  0xf8, 0x1f, 0xe7, 0xc7, 0xff, 0xff, 0xfc, 0x3f, 0xfb, 0xdf, 0xff, 0xff,
-  0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x35, 0x06, 0x08, 0x02, 0x06, 0x02, 0x04, 0x02,
+  0x0a, 0x02, 0x06, 0x06, 0x08, 0x02, 0x05, 0x03, 0x19, 0x04, 0x0b, 0x01,
+  0x04, 0x01, 0x1c, 0x02, 0x37
 };
\ No newline at end of file
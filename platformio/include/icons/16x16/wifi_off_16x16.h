@@ -1,6 +1,7 @@
-// 16 x 16
+// 16 x 16, run-length encoded
 const unsigned char wifi_off_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xe4, 0x1f, 0xe7, 0xe7, 0x9b, 0xf9,
-  0xf9, 0x9f, 0xe2, 0xcf, 0xff, 0x7f, 0xfc, 0x3f, 0xfb, 0xdf, 0xff, 0xef,
-  0xfe, 0x67, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff
+  0x10, 0x00, 0x10, 0x00, 0x23, 0x01, 0x0f, 0x02, 0x01, 0x05, 0x08, 0x02,
+  0x06, 0x02, 0x04, 0x02, 0x02, 0x01, 0x07, 0x02, 0x06, 0x02, 0x02, 0x02,
+  0x08, 0x03, 0x01, 0x01, 0x02, 0x02, 0x0c, 0x01, 0x0d, 0x04, 0x0b, 0x01,
+  0x04, 0x01, 0x10, 0x01, 0x0b, 0x02, 0x02, 0x02, 0x0f, 0x01, 0x23
 };
\ No newline at end of file
@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wind_direction_meteorological_110deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x01, 0xe0, 0x03, 0xf8, 0x0f, 0xfc, 0x1f, 0xfe, 0x0f, 0xff, 0x0f,
-  0xff, 0xcf, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
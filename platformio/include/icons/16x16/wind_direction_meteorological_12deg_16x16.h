@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wind_direction_meteorological_12deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xf8, 0xe3, 0xf8, 0x07, 0xf8, 0x0f,
-  0xf8, 0x0f, 0xfc, 0x1f, 0xfc, 0x1f, 0xfc, 0x3f, 0xfc, 0x7f, 0xfc, 0x7f,
-  0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
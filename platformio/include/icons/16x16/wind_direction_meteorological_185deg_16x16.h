@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wind_direction_meteorological_185deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f,
-  0xfc, 0x3f, 0xf8, 0x3f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f,
-  0xe3, 0x8f, 0xef, 0xcf, 0xff, 0xef, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wind_direction_meteorological_19deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xfb, 0xfc, 0x43, 0xfc, 0x07,
-  0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x1f, 0xfc, 0x3f, 0xfc, 0x7f, 0xfc, 0x7f,
-  0xfc, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
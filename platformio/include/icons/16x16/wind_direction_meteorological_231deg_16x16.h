@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wind_direction_meteorological_231deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xfe, 0x0f,
-  0xf8, 0x0f, 0xc0, 0x1f, 0x80, 0x3f, 0xe0, 0x3f, 0xf8, 0x7f, 0xf8, 0x7f,
-  0xf8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xff, 0xff
-};
\ No newline at end of file
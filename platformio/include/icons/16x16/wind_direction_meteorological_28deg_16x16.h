@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wind_direction_meteorological_28deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xfe, 0xff, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc, 0x39, 0xfc, 0x03,
-  0xfc, 0x07, 0xfc, 0x0f, 0xfc, 0x1f, 0xf8, 0x3f, 0xf8, 0x7f, 0xf8, 0xff,
-  0xf9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
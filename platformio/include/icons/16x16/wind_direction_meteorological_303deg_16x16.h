@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wind_direction_meteorological_303deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0x7f,
-  0xf0, 0x3f, 0x80, 0x1f, 0x80, 0x0f, 0xf0, 0x0f, 0xff, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wind_direction_meteorological_310deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xf8, 0x7f, 0xf8, 0x7f,
-  0xc0, 0x3f, 0x80, 0x1f, 0xe0, 0x1f, 0xf8, 0x0f, 0xff, 0x07, 0xff, 0xe7,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
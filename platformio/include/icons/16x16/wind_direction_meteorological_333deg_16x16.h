@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wind_direction_meteorological_333deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0x3f, 0xff, 0x3f, 0xfe, 0x3f, 0x86, 0x3f, 0xc0, 0x3f,
-  0xe0, 0x3f, 0xf0, 0x1f, 0xf8, 0x1f, 0xfc, 0x1f, 0xfe, 0x1f, 0xff, 0x1f,
-  0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
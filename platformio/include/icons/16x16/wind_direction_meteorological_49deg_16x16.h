@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wind_direction_meteorological_49deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xbf, 0xff, 0x3f, 0xff, 0x1f, 0xfe, 0x1f, 0xfe, 0x1f,
-  0xfc, 0x03, 0xfc, 0x01, 0xf8, 0x07, 0xf0, 0x1f, 0xf0, 0x7f, 0xe3, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file